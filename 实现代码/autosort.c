@@ -0,0 +1,368 @@
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<limits.h>
+#include<stdint.h>
+#include<omp.h>
+#include<time.h>
+#include "sorts.h"
+
+#define SAMPLE_COUNT 1024
+#define MAX_CALIB_ENTRIES 64
+
+// 默认阈值，没有加载标定表时使用
+static const double DUP_COPIES_LIMIT = 8.0;     // 平均每个键的重复次数超过此值时 Lomuto 划分会退化
+static const double HEAVY_KEY_LIMIT = 0.05;     // 单个键占样本比例超过此值时同样会退化
+static const double FEW_RUNS_LIMIT = 0.05;      // 拐点比例，约等于 (单调段数-1)/(n-2)，升序降序都算
+static const size_t PARALLEL_MIN_N = 10000;     // 小于此规模并行归并不划算
+static const size_t PARALLEL_FLOOR_N = 1000;    // mergeSortRecu 低于此规模不拆分 task，并行区域只有开销
+static const size_t RECURSIVE_MAX_N = 100000;   // 超过此规模改用迭代快排避免递归过深
+static const double CALIB_MAX_RATIO = 8.0;      // n 与标定行规模相差超过此倍数时不采用该行
+
+typedef void (*SortFunc)(void*, size_t, size_t, CompareFunc);
+
+enum { QUICK_BASIC, QUICK_MEDIAN, QUICK_ITERATIVE, MERGE_SERIAL, MERGE_PARALLEL, THIRD_ALGORITHM, ENGINE_COUNT };
+
+// 名称与基准测试 CSV 的 algorithm 列一致
+static const struct {
+    const char *name;
+    SortFunc sort;
+}engines[ENGINE_COUNT] = {
+    {"quick_basic", quick_sort_generic},
+    {"quick_median", quick_sort_median_generic},
+    {"quick_iterative", quick_sort_iterative_generic},
+    {"merge_serial", merge_sort_generic},
+    {"merge_parallel", merge_sort_parallel_generic},
+    {"third_algorithm", your_third_sort_generic},
+};
+
+typedef struct {
+    size_t n;
+    double turn_ratio;   // 相邻两对方向相反（升转降或降转升）的比例
+    double distinct;     // 估计的不同键个数
+    double heavy_ratio;  // 样本中出现最多的键所占比例
+    int threads;
+}SampleStats;
+
+typedef struct {
+    char data_type[16];
+    size_t size;
+    double time[ENGINE_COUNT]; // <0 表示该算法没有记录
+}CalibRow;
+
+static CalibRow calib[MAX_CALIB_ENTRIES];
+static int calib_count = 0;
+
+static int engine_by_name(const char *name){
+    for(int i=0;i<ENGINE_COUNT;i++){
+        if(strcmp(engines[i].name,name)==0) return i;
+    }
+    return -1;
+}
+
+// 标定表里只记录 int / float，按元素大小对应
+static size_t elem_size_of(const char *data_type){
+    if(strcmp(data_type,"int")==0) return sizeof(int);
+    if(strcmp(data_type,"float")==0 || strcmp(data_type,"double")==0) return sizeof(double);
+    return 0;
+}
+
+// Reads the benchmark CSV into one row per (data_type, size) holding every successful timing.
+// Returns the number of rows kept, -1 if the file cannot be opened,
+// or -2 if rows beyond MAX_CALIB_ENTRIES had to be dropped (the rows kept are still used).
+int auto_sort_load_calibration(const char *csv_path){
+    FILE *f = fopen(csv_path, "r");
+    if(!f) return -1;
+    char line[256];
+    int dropped = 0;
+    calib_count = 0;
+    while(fgets(line, sizeof(line), f)){
+        char algo[64], type[16], dataset[128], status[32];
+        unsigned long size;
+        double t;
+        if(sscanf(line, "%63[^,],%15[^,],%127[^,],%lu,%lf,%31[^,\r\n]",
+                  algo, type, dataset, &size, &t, status) != 6) continue; // header / blank line
+        if(strcmp(status,"success")!=0) continue;
+        int e = engine_by_name(algo);
+        if(e<0) continue;
+        int i;
+        for(i=0;i<calib_count;i++){
+            if(calib[i].size==size && strcmp(calib[i].data_type,type)==0) break;
+        }
+        if(i==calib_count){
+            if(calib_count>=MAX_CALIB_ENTRIES){ dropped = 1; continue; }
+            calib_count++;
+            strcpy(calib[i].data_type, type);
+            calib[i].size = size;
+            for(int k=0;k<ENGINE_COUNT;k++) calib[i].time[k] = -1.0;
+        }
+        if(calib[i].time[e]<0 || t<calib[i].time[e]) calib[i].time[e] = t;
+    }
+    fclose(f);
+    return dropped ? -2 : calib_count;
+}
+
+static int row_matches(const CalibRow *row, size_t size){
+    return elem_size_of(row->data_type)==size;
+}
+
+#define ENGINE_BIT(e) (1u << (e))
+// 适合任意形态的串行算法，以及不受重复键和有序段影响的串行算法
+static const unsigned SERIAL_ALL = ~ENGINE_BIT(MERGE_PARALLEL) & (ENGINE_BIT(ENGINE_COUNT) - 1);
+static const unsigned SERIAL_DUP_SAFE = ENGINE_BIT(MERGE_SERIAL) | ENGINE_BIT(THIRD_ALGORITHM);
+
+// 该行中 mask 内最快的算法，没有记录时返回 -1
+static int row_best(const CalibRow *row, unsigned mask){
+    int best = -1;
+    for(int e=0;e<ENGINE_COUNT;e++){
+        if(!(mask & ENGINE_BIT(e)) || row->time[e]<0) continue;
+        if(best<0 || row->time[e]<row->time[best]) best = e;
+    }
+    return best;
+}
+
+// Smallest calibrated size from which merge_parallel beats every engine in `rivals` at that size
+// and all larger ones, or SIZE_MAX if it never wins. Only rows with timings for both are used, and
+// only while n lies within CALIB_MAX_RATIO of their size range; otherwise PARALLEL_MIN_N applies.
+static size_t fit_parallel_min_n(size_t n, size_t size, unsigned rivals){
+    size_t fitted = SIZE_MAX;
+    size_t lo = SIZE_MAX, hi = 0;
+    // 从大到小找连续获胜的区间
+    size_t upper = SIZE_MAX;
+    int winning = 1;
+    for(;;){
+        int row = -1;
+        for(int i=0;i<calib_count;i++){
+            if(!row_matches(&calib[i],size) || calib[i].size>=upper) continue;
+            if(row<0 || calib[i].size>calib[row].size) row = i;
+        }
+        if(row<0) break;
+        upper = calib[row].size;
+        int rival = row_best(&calib[row], rivals);
+        if(calib[row].time[MERGE_PARALLEL]<0 || rival<0) continue;
+        if(calib[row].size<lo) lo = calib[row].size;
+        if(calib[row].size>hi) hi = calib[row].size;
+        if(calib[row].time[MERGE_PARALLEL] >= calib[row].time[rival]) winning = 0;
+        if(winning) fitted = calib[row].size;
+    }
+    if(hi==0 || (double)n > (double)hi*CALIB_MAX_RATIO || (double)n*CALIB_MAX_RATIO < (double)lo){
+        return PARALLEL_MIN_N;
+    }
+    return fitted;
+}
+
+static int use_parallel(const SampleStats *st, size_t size, unsigned rivals){
+    if(st->threads<=1 || st->n<PARALLEL_FLOOR_N) return 0;
+    return st->n >= fit_parallel_min_n(st->n, size, rivals);
+}
+
+// 规模最接近（按比例）且在 CALIB_MAX_RATIO 以内的同元素大小标定行
+static const CalibRow *calib_nearest(size_t n, size_t size){
+    const CalibRow *best = NULL;
+    double best_dist = 0.0;
+    for(int i=0;i<calib_count;i++){
+        if(!row_matches(&calib[i],size) || calib[i].size==0) continue;
+        double a = (double)n, b = (double)calib[i].size;
+        double dist = a > b ? a / b : b / a;
+        if(dist>CALIB_MAX_RATIO) continue;
+        if(!best || dist<best_dist){
+            best = &calib[i];
+            best_dist = dist;
+        }
+    }
+    return best;
+}
+
+// i 号样本在 [i*step, (i+1)*step) 内的位置，用乘法哈希做确定性抖动，避免与周期性数据对齐
+static size_t sample_pos(size_t i, size_t step){
+    return i*step + (size_t)((i * 2654435761u) % step);
+}
+
+// Looks at up to SAMPLE_COUNT jittered positions, so the cost does not grow with n.
+static SampleStats sample_input(const void *base, size_t num, size_t size, CompareFunc compare){
+    SampleStats st = {num, 1.0, (double)num, 0.0, omp_get_max_threads()};
+    const char *arr=(const char*)base;
+    size_t k = num < SAMPLE_COUNT ? num : SAMPLE_COUNT;
+    size_t step = num / k;
+
+    // 每个样本看 pos, pos+1, pos+2 三个元素，两对方向相反即为一个单调段的边界
+    int turns = 0, triples = 0;
+    for(size_t i=0;i<k;i++){
+        size_t pos = sample_pos(i, step);
+        if(pos+2>=num) break;
+        int c1 = compare(arr+pos*size, arr+(pos+1)*size);
+        int c2 = compare(arr+(pos+1)*size, arr+(pos+2)*size);
+        if((c1<0 && c2>0) || (c1>0 && c2<0)) turns++;
+        triples++;
+    }
+    if(triples) st.turn_ratio = (double)turns / triples;
+
+    // 去重估计只用 n/4 个样本，避免小数组上采样比排序本身还贵
+    if(k > num/4) k = num/4;
+    if(k < 16) return st;
+    step = num / k;
+    char *buf = malloc(k*size);
+    if(!buf) return st;
+    for(size_t i=0;i<k;i++){
+        memcpy(buf+i*size, arr+sample_pos(i, step)*size, size);
+    }
+    qsort(buf, k, size, compare);
+    // 偏差修正的 Chao1 估计: d + f1(f1-1)/(2(f2+1))，f1/f2 为样本中恰好出现一次/两次的键数
+    size_t d = 0, f1 = 0, f2 = 0, run = 1, longest = 1;
+    for(size_t i=1;i<=k;i++){
+        if(i<k && compare(buf+(i-1)*size, buf+i*size)==0){ run++; continue; }
+        d++;
+        if(run==1) f1++;
+        else if(run==2) f2++;
+        if(run>longest) longest = run;
+        run = 1;
+    }
+    free(buf);
+    if(longest>1) st.heavy_ratio = (double)longest / k;
+    if(f1<d){ // 样本里没有重复键时没有依据，按全不同处理
+        double est = (double)d + (double)f1 * (f1 - 1) / (2.0 * (f2 + 1));
+        st.distinct = est < (double)num ? est : (double)num;
+    }
+    return st;
+}
+
+static int pick_engine(const void *base, size_t num, size_t size, CompareFunc compare){
+    // 其余实现都用 int 下标
+    if(num > INT_MAX) return THIRD_ALGORITHM;
+
+    SampleStats st = sample_input(base, num, size, compare);
+    const CalibRow *row = calib_nearest(num, size);
+    int e = -1;
+
+    // 标定表只记录规模，不记录数据形态，所以先按采样结果确定候选算法，再用标定表在其中选择。
+    // Lomuto 划分在单调段很少（升序或降序）、平均重复度高或有单个高频键时都会退化到平方级
+    if(st.turn_ratio <= FEW_RUNS_LIMIT
+       || (double)num / st.distinct >= DUP_COPIES_LIMIT
+       || st.heavy_ratio > HEAVY_KEY_LIMIT){
+        if(use_parallel(&st, size, SERIAL_DUP_SAFE)) return MERGE_PARALLEL;
+        if(row) e = row_best(row, SERIAL_DUP_SAFE);
+        return e<0 ? THIRD_ALGORITHM : e;
+    }
+    if(use_parallel(&st, size, SERIAL_ALL)) return MERGE_PARALLEL;
+
+    if(row) e = row_best(row, SERIAL_ALL);
+    if(e<0) e = num>RECURSIVE_MAX_N ? QUICK_ITERATIVE : QUICK_BASIC;
+    if((e==QUICK_BASIC || e==QUICK_MEDIAN) && num>RECURSIVE_MAX_N) e = QUICK_ITERATIVE;
+    return e;
+}
+
+void auto_sort_generic(void* base, size_t num, size_t size, CompareFunc compare) {
+    if (num < 2) return;
+    engines[pick_engine(base, num, size, compare)].sort(base, num, size, compare);
+}
+
+const char* auto_sort_engine_name(const void* base, size_t num, size_t size, CompareFunc compare) {
+    if (num < 2) return engines[THIRD_ALGORITHM].name;
+    return engines[pick_engine(base, num, size, compare)].name;
+}
+
+
+#ifdef STANDALONE_AUTOSORT
+// --- 文件读取与主流程 ---
+static int compareint(const void *a,const void *b){
+    return (*(int*)a-*(int*)b);
+}
+
+static int compareDouble(const void *a,const void *b){
+    if(*(double*)a<*(double*)b)return -1;
+    else if(*(double*)a>*(double*)b)return 1;
+    else return 0;
+}
+
+static int *read_ints_from_file(const char *path, size_t *out_count){
+    FILE *f = fopen(path, "r");
+    if(!f) return NULL;
+    size_t cap = 1024, n = 0;
+    int *arr = malloc(cap * sizeof(int));
+    char line[128];
+    while(fgets(line, sizeof(line), f)){
+        char *p = line;
+        while(*p==' '||*p=='\t') p++;
+        if(*p==0||*p=='\n'||*p=='\r') continue;
+        int v = atoi(p);
+        if(n>=cap){ cap*=2; arr=realloc(arr,cap*sizeof(int)); }
+        arr[n++] = v;
+    }
+    fclose(f);
+    *out_count = n;
+    return arr;
+}
+
+static double *read_doubles_from_file(const char *path, size_t *out_count){
+    FILE *f = fopen(path, "r");
+    if(!f) return NULL;
+    size_t cap = 1024, n = 0;
+    double *arr = malloc(cap * sizeof(double));
+    char line[128];
+    while(fgets(line, sizeof(line), f)){
+        char *p = line;
+        while(*p==' '||*p=='\t') p++;
+        if(*p==0||*p=='\n'||*p=='\r') continue;
+        double v = atof(p);
+        if(n>=cap){ cap*=2; arr=realloc(arr,cap*sizeof(double)); }
+        arr[n++] = v;
+    }
+    fclose(f);
+    *out_count = n;
+    return arr;
+}
+
+static int is_sorted_int(const int *a, size_t n){
+    for(size_t i=1;i<n;i++) if(a[i-1]>a[i]) return 0;
+    return 1;
+}
+static int is_sorted_double(const double *a, size_t n){
+    for(size_t i=1;i<n;i++) if(a[i-1]>a[i]) return 0;
+    return 1;
+}
+
+static void print_usage(const char *prog){
+    fprintf(stderr, "Usage: %s <input_file> <type> [calibration_csv]\n", prog);
+    fprintf(stderr, "type: int | float\n");
+}
+
+int main(int argc, char **argv){
+    if(argc<3){ print_usage(argv[0]); return 1; }
+    const char *path = argv[1];
+    const char *type = argv[2];
+    size_t n=0;
+    double time_ms=0.0;
+    int correct=0;
+    srand((unsigned)time(NULL));
+    if(argc>=4){
+        int rows = auto_sort_load_calibration(argv[3]);
+        if(rows==-1) fprintf(stderr, "Failed to open %s, using default thresholds\n", argv[3]);
+        else if(rows==-2) fprintf(stderr, "Too many rows in %s, extra rows ignored\n", argv[3]);
+    }
+    if(strcmp(type,"int")==0){
+        int *arr = read_ints_from_file(path,&n);
+        if(!arr){ fprintf(stderr, "Failed to open or parse %s\n", path); return 2; }
+        double start_time = omp_get_wtime();
+        auto_sort_generic(arr, n, sizeof(int), compareint);
+        double end_time = omp_get_wtime();
+        time_ms = (end_time - start_time) * 1000.0;
+        correct = is_sorted_int(arr,n);
+        free(arr);
+    } else if(strcmp(type,"float")==0){
+        double *arr = read_doubles_from_file(path,&n);
+        if(!arr){ fprintf(stderr, "Failed to open or parse %s\n", path); return 2; }
+        double start_time = omp_get_wtime();
+        auto_sort_generic(arr, n, sizeof(double), compareDouble);
+        double end_time = omp_get_wtime();
+        time_ms = (end_time - start_time) * 1000.0;
+        correct = is_sorted_double(arr,n);
+        free(arr);
+    } else {
+        print_usage(argv[0]); return 3;
+    }
+    printf("TIME_MS:%.3f\n", time_ms);
+    printf("CORRECT:%d\n", correct);
+    return 0;
+}
+
+#endif /* STANDALONE_AUTOSORT */
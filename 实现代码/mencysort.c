@@ -170,6 +170,8 @@ int main(int argc, char **argv){
     return 0;
 }
 
+#endif /* STANDALONE_MENCYSORT */
+
 // Generic wrappers to match sorts.h declarations
 void merge_sort_generic(void* base, size_t num, size_t size, CompareFunc compare) {
     if (num == 0) return;
@@ -185,5 +187,3 @@ void merge_sort_parallel_generic(void* base, size_t num, size_t size, CompareFun
         mergeSortRecu(base, 0, (int)num - 1, (int)size, (int(*)(const void*,const void*))compare);
     }
 }
-
-#endif /* STANDALONE_MENCYSORT */
\ No newline at end of file
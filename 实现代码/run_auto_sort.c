@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+#include "sorts.h"
+
+#define TIME_LIMIT_MS 3000.0
+#define TMP_CSV "run_auto_sort_tmp.csv"
+
+static int compare_int(const void* a, const void* b){
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static void fill_random(int *a, size_t n){ for(size_t i=0;i<n;i++) a[i] = rand(); }
+static void fill_sorted(int *a, size_t n){ for(size_t i=0;i<n;i++) a[i] = (int)i; }
+static void fill_reverse(int *a, size_t n){ for(size_t i=0;i<n;i++) a[i] = (int)(n - i); }
+static void fill_organ_pipe(int *a, size_t n){
+    for(size_t i=0;i<n;i++) a[i] = (int)(i < n/2 ? i : n - i);
+}
+// 有序数组中每隔 100 个位置放一个随机值
+static void fill_periodic_noise(int *a, size_t n){
+    for(size_t i=0;i<n;i++) a[i] = i % 100 == 0 ? rand() % (int)n : (int)i;
+}
+static void fill_few_distinct(int *a, size_t n){ for(size_t i=0;i<n;i++) a[i] = rand() % 6; }
+static void fill_moderate_dup(int *a, size_t n){ for(size_t i=0;i<n;i++) a[i] = rand() % 1000; }
+static void fill_heavy_half(int *a, size_t n){ for(size_t i=0;i<n;i++) a[i] = rand() % 2 ? 0 : rand(); }
+static void fill_heavy_quarter(int *a, size_t n){ for(size_t i=0;i<n;i++) a[i] = rand() % 4 ? rand() : 0; }
+
+static int is_quick(const char *name){
+    return strncmp(name, "quick_", 6) == 0;
+}
+
+typedef struct {
+    const char *name;
+    void (*fill)(int*, size_t);
+    size_t n;
+    int quick_ok; // 0 表示该形态会让 Lomuto 快排退化，不允许选中 quick_*
+}Case;
+
+// 对每种输入检查结果有序、耗时在限制内，以及选择的算法是否符合数据形态
+static int run_cases(const char *label){
+    const Case cases[] = {
+        {"random", fill_random, 200000, 1},
+        {"random_large", fill_random, 1000000, 1},
+        {"sorted", fill_sorted, 1000000, 0},
+        {"reverse", fill_reverse, 1000000, 0},
+        {"organ_pipe", fill_organ_pipe, 200000, 0},
+        {"periodic_noise", fill_periodic_noise, 200000, 0},
+        {"few_distinct", fill_few_distinct, 200000, 0},
+        {"moderate_dup", fill_moderate_dup, 1000000, 0},
+        {"heavy_key_half", fill_heavy_half, 200000, 0},
+        {"heavy_key_quarter", fill_heavy_quarter, 200000, 0},
+    };
+    int failed = 0;
+    for(size_t c=0;c<sizeof(cases)/sizeof(cases[0]);c++){
+        size_t n = cases[c].n;
+        int *arr = malloc(n * sizeof(int));
+        if(!arr){ fprintf(stderr, "malloc failed\n"); return 1; }
+        srand(42);
+        cases[c].fill(arr, n);
+        const char *engine = auto_sort_engine_name(arr, n, sizeof(int), compare_int);
+        int ok = 1;
+        // 先检查选择，避免在退化的算法上白白等待
+        if(!cases[c].quick_ok && is_quick(engine)) ok = 0;
+        if(n > 100000 && (strcmp(engine, "quick_basic") == 0 || strcmp(engine, "quick_median") == 0)) ok = 0;
+        double ms = 0.0;
+        if(ok){
+            double start = omp_get_wtime();
+            auto_sort_generic(arr, n, sizeof(int), compare_int);
+            ms = (omp_get_wtime() - start) * 1000.0;
+            for(size_t i=1;i<n;i++) if(arr[i-1] > arr[i]){ ok = 0; break; }
+            if(ms > TIME_LIMIT_MS) ok = 0;
+        }
+        printf("%s,%s,%zu,%s,%.3f,%s\n", label, cases[c].name, n, engine, ms, ok ? "success" : "FAILED");
+        if(!ok) failed = 1;
+        free(arr);
+    }
+    return failed;
+}
+
+static int check(int cond, const char *what){
+    printf("loader,%s,%s\n", what, cond ? "success" : "FAILED");
+    return cond ? 0 : 1;
+}
+
+static const char *engine_for(void (*fill)(int*, size_t), size_t n){
+    static char name[32];
+    int *arr = malloc(n * sizeof(int));
+    if(!arr) return "";
+    srand(42);
+    fill(arr, n);
+    strncpy(name, auto_sort_engine_name(arr, n, sizeof(int), compare_int), sizeof(name) - 1);
+    free(arr);
+    return name;
+}
+
+// 用临时 CSV 检查标定表的读取和选行规则
+static int run_loader_cases(void){
+    int failed = 0;
+    FILE *f;
+
+    failed |= check(auto_sort_load_calibration("no_such_calibration.csv") == -1, "missing_file_returns_-1");
+
+    f = fopen(TMP_CSV, "w");
+    if(!f){ fprintf(stderr, "Failed to write %s\n", TMP_CSV); return 1; }
+    fprintf(f, "algorithm,data_type,dataset,size,time,status\n");
+    for(int i=1;i<=100;i++) fprintf(f, "quick_basic,int,d%d.txt,%d,0.001,success\n", i, i * 10);
+    fclose(f);
+    failed |= check(auto_sort_load_calibration(TMP_CSV) == -2, "table_overflow_returns_-2");
+
+    // third_algorithm 在 1000 行最快但状态不是 success，必须被忽略
+    // merge_parallel 处处更慢，拟合出的并行阈值应为“从不并行”
+    f = fopen(TMP_CSV, "w");
+    if(!f){ fprintf(stderr, "Failed to write %s\n", TMP_CSV); return 1; }
+    fprintf(f, "algorithm,data_type,dataset,size,time,status\n");
+    fprintf(f, "quick_basic,int,a.txt,1000,0.010,success\n");
+    fprintf(f, "merge_serial,int,a.txt,1000,0.020,success\n");
+    fprintf(f, "merge_parallel,int,a.txt,1000,0.050,success\n");
+    fprintf(f, "third_algorithm,int,a.txt,1000,0.001,failed\n");
+    fprintf(f, "\n");
+    fprintf(f, "quick_basic,int,b.txt,100000,2.000,success\n");
+    fprintf(f, "merge_serial,int,b.txt,100000,1.000,success\n");
+    fprintf(f, "merge_parallel,int,b.txt,100000,3.000,success\n");
+    fclose(f);
+    failed |= check(auto_sort_load_calibration(TMP_CSV) == 2, "rows_grouped_by_size");
+    remove(TMP_CSV);
+
+    failed |= check(strcmp(engine_for(fill_random, 2000), "quick_basic") == 0, "nearest_row_small");
+    failed |= check(strcmp(engine_for(fill_random, 30000), "merge_serial") == 0, "nearest_row_by_ratio");
+    failed |= check(strcmp(engine_for(fill_sorted, 2000), "merge_serial") == 0, "failed_rows_ignored");
+    // 2000000 离 100000 超过 CALIB_MAX_RATIO，回到默认规则
+    const char *expect = omp_get_max_threads() > 1 ? "merge_parallel" : "quick_iterative";
+    failed |= check(strcmp(engine_for(fill_random, 2000000), expect) == 0, "rows_beyond_ratio_ignored");
+    return failed;
+}
+
+int main(int argc, char **argv){
+    const char *csv = argc > 1 ? argv[1] : "sorting_results_example.csv";
+    int failed = 0;
+    printf("calibration,dataset,size,algorithm,time_ms,status\n");
+    failed |= run_cases("default");
+    failed |= run_loader_cases();
+    if(auto_sort_load_calibration(csv) < 0){
+        fprintf(stderr, "Failed to load %s\n", csv);
+        return 1;
+    }
+    failed |= run_cases("calibrated");
+    return failed;
+}
@@ -12,4 +12,20 @@ void merge_sort_generic(void* base, size_t num, size_t size, CompareFunc compare
 void merge_sort_parallel_generic(void* base, size_t num, size_t size, CompareFunc compare);
 void your_third_sort_generic(void* base, size_t num, size_t size, CompareFunc compare);
 
+// Samples the input and dispatches to one of the sorts above.
+// The sample estimates the number of monotone runs (ascending or descending), the number of
+// distinct keys and the share of the most frequent key; n, element size and OpenMP thread count
+// are also used. Inputs with few runs or heavy duplication never go to the quicksorts.
+// Key range is not sampled: the sorts only see an opaque comparator, so there is no numeric key.
+// The shape decides which sorts are candidates; a calibration CSV (same format as
+// sorting_results_example.csv) loaded with auto_sort_load_calibration() then picks among them
+// and fits the parallel threshold, otherwise built-in defaults are used.
+void auto_sort_generic(void* base, size_t num, size_t size, CompareFunc compare);
+// Returns the CSV algorithm name auto_sort_generic would use for this input, without sorting.
+const char* auto_sort_engine_name(const void* base, size_t num, size_t size, CompareFunc compare);
+// Returns the number of rows loaded, -1 if the file cannot be opened, or -2 if the table
+// was full and some rows were dropped. The table is a process-wide global with no locking:
+// loading must finish before any auto_sort_* call starts on another thread.
+int auto_sort_load_calibration(const char* csv_path);
+
 #endif